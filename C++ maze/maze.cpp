@@ -9,9 +9,37 @@
 #include <iomanip>
 #include <string>
 #include <fstream>
+#include <tuple>
+#include <cmath>
+
+#include "mzc.h"
 
 using namespace std;
 
+// Available maze generation algorithms
+enum class GenAlgorithm {
+    Backtracker = 1, // long winding corridors, few dead ends
+    Wilson,          // uniform spanning tree (unbiased)
+    Kruskal,         // many short dead ends
+    Prim,            // many short dead ends, radial texture
+    BinaryTree,      // strong diagonal bias, open top row and left column
+    Sidewinder       // vertical bias, open top row
+};
+
+const int NUM_ALGORITHMS = 6;
+
+string algorithmName(GenAlgorithm alg) {
+    switch (alg) {
+        case GenAlgorithm::Backtracker: return "Recursive backtracker";
+        case GenAlgorithm::Wilson:      return "Wilson";
+        case GenAlgorithm::Kruskal:     return "Kruskal";
+        case GenAlgorithm::Prim:        return "Prim";
+        case GenAlgorithm::BinaryTree:  return "Binary tree";
+        case GenAlgorithm::Sidewinder:  return "Sidewinder";
+    }
+    return "Unknown";
+}
+
 // Directions: 0 = top, 1 = right, 2 = bottom, 3 = left
 struct Cell {
     bool walls[4] = {true, true, true, true}; // top, right, bottom, left
@@ -32,12 +60,12 @@ public:
         return (r >= 0 && r < rows && c >= 0 && c < cols);
     }
 
-    // Generate maze using recursive backtracking (iterative with stack)
-    void generateMaze() {
-        // Initialize random seed
-        srand(time(nullptr));
-        
-        // Reset all cells
+    // Peak heap bytes held by the generator's working containers on the
+    // last run (capacity, including per-row vector headers)
+    size_t auxBytes = 0;
+
+    // Reset all cells to fully walled and unvisited
+    void resetGrid() {
         for (int i = 0; i < rows; i++) {
             for (int j = 0; j < cols; j++) {
                 grid[i][j].visited = false;
@@ -46,18 +74,55 @@ public:
                 }
             }
         }
-        
-        // Using stack for DFS
-        stack<pair<int,int>> st;
+    }
+
+    // Remove the wall between (r, c) and its neighbor in direction d
+    void removeWall(int r, int c, int d) {
+        static const int dr[4] = {-1, 0, 1, 0};
+        static const int dc[4] = {0, 1, 0, -1};
+        grid[r][c].walls[d] = false;
+        grid[r + dr[d]][c + dc[d]].walls[(d + 2) % 4] = false;
+    }
+
+    // Generate maze with the selected algorithm, then optionally add loops.
+    // braidFraction is the fraction (0..1) of dead ends to remove.
+    // The same seed always produces the same maze.
+    void generateMaze(unsigned seed, GenAlgorithm alg = GenAlgorithm::Backtracker, double braidFraction = 0.0) {
+        srand(seed);
+
+        resetGrid();
+        auxBytes = 0;
+
+        switch (alg) {
+            case GenAlgorithm::Backtracker: generateBacktracker(); break;
+            case GenAlgorithm::Wilson:      generateWilson();      break;
+            case GenAlgorithm::Kruskal:     generateKruskal();     break;
+            case GenAlgorithm::Prim:        generatePrim();        break;
+            case GenAlgorithm::BinaryTree:  generateBinaryTree();  break;
+            case GenAlgorithm::Sidewinder:  generateSidewinder();  break;
+        }
+
+        if (braidFraction > 0.0) {
+            braidMaze(braidFraction);
+        }
+    }
+
+    // Generate maze using recursive backtracking (iterative with stack)
+    void generateBacktracker() {
+        // Using a vector as the DFS stack so its memory is easy to measure
+        vector<pair<int,int>> st;
         grid[0][0].visited = true;
-        st.push({0,0});
+        st.push_back({0,0});
         
         int dr[4] = {-1, 0, 1, 0};
         int dc[4] = {0, 1, 0, -1};
 
+        vector<tuple<int,int,int>> neighbors; // tuple: (nr, nc, direction)
+        neighbors.reserve(4);
+
         while(!st.empty()) {
-            auto [r, c] = st.top();
-            vector<tuple<int,int,int>> neighbors; // tuple: (nr, nc, direction)
+            auto [r, c] = st.back();
+            neighbors.clear();
             
             for (int d = 0; d < 4; d++) {
                 int nr = r + dr[d], nc = c + dc[d];
@@ -67,7 +132,7 @@ public:
             }
             
             if(neighbors.empty()) {
-                st.pop();
+                st.pop_back();
             } else {
                 auto [nr, nc, d] = neighbors[rand() % neighbors.size()];
                 // Remove wall between current cell and neighbor
@@ -75,11 +140,283 @@ public:
                 int opposite = (d + 2) % 4;
                 grid[nr][nc].walls[opposite] = false;
                 grid[nr][nc].visited = true;
-                st.push({nr, nc});
+                st.push_back({nr, nc});
+            }
+        }
+        // A vector never shrinks, so its capacity is the peak
+        auxBytes = st.capacity() * sizeof(pair<int,int>)
+                 + neighbors.capacity() * sizeof(tuple<int,int,int>);
+    }
+
+    // Generate maze using Wilson's algorithm (loop-erased random walks).
+    // Produces a uniform spanning tree, so it has no directional bias.
+    void generateWilson() {
+        int total = rows * cols;
+        // Last direction taken out of each cell during the current walk
+        vector<int> walkDir(total, -1);
+        auxBytes = walkDir.capacity() * sizeof(int);
+
+        int dr[4] = {-1, 0, 1, 0};
+        int dc[4] = {0, 1, 0, -1};
+
+        int first = rand() % total;
+        grid[first / cols][first % cols].visited = true;
+
+        for (int startCell = 0; startCell < total; startCell++) {
+            if (grid[startCell / cols][startCell % cols].visited)
+                continue;
+
+            // Random walk until we hit the maze. Overwriting walkDir on
+            // revisits erases any loops the walk made.
+            int r = startCell / cols, c = startCell % cols;
+            while (!grid[r][c].visited) {
+                int d;
+                do {
+                    d = rand() % 4;
+                } while (!inBounds(r + dr[d], c + dc[d]));
+                walkDir[r * cols + c] = d;
+                r += dr[d];
+                c += dc[d];
+            }
+
+            // Carve the loop-erased path into the maze
+            r = startCell / cols;
+            c = startCell % cols;
+            while (!grid[r][c].visited) {
+                int d = walkDir[r * cols + c];
+                grid[r][c].visited = true;
+                removeWall(r, c, d);
+                r += dr[d];
+                c += dc[d];
+            }
+        }
+    }
+
+    // Find set representative with path compression (used by Kruskal)
+    static int findSet(vector<int>& parent, int x) {
+        int root = x;
+        while (parent[root] != root)
+            root = parent[root];
+        while (parent[x] != root) {
+            int next = parent[x];
+            parent[x] = root;
+            x = next;
+        }
+        return root;
+    }
+
+    // Generate maze using randomized Kruskal's algorithm with union-find
+    void generateKruskal() {
+        int total = rows * cols;
+        vector<int> parent(total), setSize(total, 1);
+        for (int i = 0; i < total; i++)
+            parent[i] = i;
+
+        // Every interior wall, stored as (cell index, direction) with
+        // direction 1 (right) or 2 (bottom)
+        vector<pair<int,int>> edges;
+        edges.reserve(2 * total);
+        for (int i = 0; i < rows; i++) {
+            for (int j = 0; j < cols; j++) {
+                if (j + 1 < cols) edges.push_back({i * cols + j, 1});
+                if (i + 1 < rows) edges.push_back({i * cols + j, 2});
+            }
+        }
+        auxBytes = (parent.capacity() + setSize.capacity()) * sizeof(int)
+                 + edges.capacity() * sizeof(pair<int,int>);
+
+        // Fisher-Yates shuffle
+        for (int i = (int)edges.size() - 1; i > 0; i--) {
+            swap(edges[i], edges[rand() % (i + 1)]);
+        }
+
+        int joined = 1;
+        for (auto [cell, d] : edges) {
+            if (joined == total)
+                break;
+            int other = (d == 1) ? cell + 1 : cell + cols;
+            int a = findSet(parent, cell), b = findSet(parent, other);
+            if (a == b)
+                continue;
+            // Union by size keeps the trees shallow
+            if (setSize[a] < setSize[b])
+                swap(a, b);
+            parent[b] = a;
+            setSize[a] += setSize[b];
+            removeWall(cell / cols, cell % cols, d);
+            joined++;
+        }
+    }
+
+    // Generate maze using randomized Prim's algorithm
+    void generatePrim() {
+        vector<vector<bool>> inFrontier(rows, vector<bool>(cols, false));
+        vector<pair<int,int>> frontier;
+
+        int dr[4] = {-1, 0, 1, 0};
+        int dc[4] = {0, 1, 0, -1};
+
+        auto addFrontier = [&](int r, int c) {
+            for (int d = 0; d < 4; d++) {
+                int nr = r + dr[d], nc = c + dc[d];
+                if (inBounds(nr, nc) && !grid[nr][nc].visited && !inFrontier[nr][nc]) {
+                    inFrontier[nr][nc] = true;
+                    frontier.push_back({nr, nc});
+                }
+            }
+        };
+
+        int sr = rand() % rows, sc = rand() % cols;
+        grid[sr][sc].visited = true;
+        addFrontier(sr, sc);
+
+        while (!frontier.empty()) {
+            // Pick a random frontier cell and remove it in O(1)
+            int idx = rand() % frontier.size();
+            auto [r, c] = frontier[idx];
+            frontier[idx] = frontier.back();
+            frontier.pop_back();
+
+            // Connect it to a random neighbor that is already in the maze
+            int dirs[4], count = 0;
+            for (int d = 0; d < 4; d++) {
+                int nr = r + dr[d], nc = c + dc[d];
+                if (inBounds(nr, nc) && grid[nr][nc].visited)
+                    dirs[count++] = d;
+            }
+            removeWall(r, c, dirs[rand() % count]);
+            grid[r][c].visited = true;
+            addFrontier(r, c);
+        }
+        auxBytes = frontier.capacity() * sizeof(pair<int,int>)
+                 + rows * (sizeof(vector<bool>) + (cols + 7) / 8);
+    }
+
+    // Generate maze using the binary tree algorithm: each cell opens
+    // either its top or its left wall
+    void generateBinaryTree() {
+        for (int i = 0; i < rows; i++) {
+            for (int j = 0; j < cols; j++) {
+                if (i > 0 && j > 0)
+                    removeWall(i, j, (rand() % 2) ? 0 : 3);
+                else if (i > 0)
+                    removeWall(i, j, 0);
+                else if (j > 0)
+                    removeWall(i, j, 3);
             }
         }
     }
 
+    // Generate maze using the sidewinder algorithm: carve horizontal runs
+    // and open one cell of each run upward
+    void generateSidewinder() {
+        for (int i = 0; i < rows; i++) {
+            int runStart = 0;
+            for (int j = 0; j < cols; j++) {
+                bool atRightEdge = (j == cols - 1);
+                bool closeRun = atRightEdge || (i > 0 && rand() % 2 == 0);
+                if (closeRun) {
+                    if (i > 0) {
+                        int k = runStart + rand() % (j - runStart + 1);
+                        removeWall(i, k, 0);
+                    }
+                    runStart = j + 1;
+                } else {
+                    removeWall(i, j, 1);
+                }
+            }
+        }
+    }
+
+    // Count the walls around a cell that could be opened (not the border)
+    int openableWalls(int r, int c, int dirs[4]) const {
+        static const int dr[4] = {-1, 0, 1, 0};
+        static const int dc[4] = {0, 1, 0, -1};
+        int count = 0;
+        for (int d = 0; d < 4; d++) {
+            if (grid[r][c].walls[d] && inBounds(r + dr[d], c + dc[d]))
+                dirs[count++] = d;
+        }
+        return count;
+    }
+
+    // A dead end is a cell with exactly one opening
+    bool isDeadEnd(int r, int c) const {
+        int open = 0;
+        for (int d = 0; d < 4; d++) {
+            if (!grid[r][c].walls[d])
+                open++;
+        }
+        return open == 1;
+    }
+
+    // Remove dead ends to add loops, making the maze imperfect.
+    // Removes round(braidFraction * deadEnds) dead ends, picked at random.
+    // Opening a dead end into a neighboring dead end removes both, so that
+    // is preferred while two or more removals remain; the total is never
+    // exceeded.
+    void braidMaze(double braidFraction) {
+        int dr[4] = {-1, 0, 1, 0};
+        int dc[4] = {0, 1, 0, -1};
+
+        vector<pair<int,int>> deadEnds;
+        for (int i = 0; i < rows; i++) {
+            for (int j = 0; j < cols; j++) {
+                if (isDeadEnd(i, j))
+                    deadEnds.push_back({i, j});
+            }
+        }
+        // Fisher-Yates shuffle
+        for (int i = (int)deadEnds.size() - 1; i > 0; i--) {
+            swap(deadEnds[i], deadEnds[rand() % (i + 1)]);
+        }
+
+        int target = (int)lround(braidFraction * deadEnds.size());
+        int removed = 0;
+        for (auto [i, j] : deadEnds) {
+            if (removed >= target)
+                break;
+            // Already removed by joining it to an earlier dead end
+            if (!isDeadEnd(i, j))
+                continue;
+
+            int dirs[4];
+            int count = openableWalls(i, j, dirs);
+
+            int joins[4], joinCount = 0, plain[4], plainCount = 0;
+            for (int k = 0; k < count; k++) {
+                if (isDeadEnd(i + dr[dirs[k]], j + dc[dirs[k]]))
+                    joins[joinCount++] = dirs[k];
+                else
+                    plain[plainCount++] = dirs[k];
+            }
+            if (joinCount > 0 && target - removed >= 2) {
+                removeWall(i, j, joins[rand() % joinCount]);
+                removed += 2;
+            } else if (plainCount > 0) {
+                removeWall(i, j, plain[rand() % plainCount]);
+                removed++;
+            }
+        }
+    }
+
+    // Count dead ends, a quick measure of the maze's shape
+    int countDeadEnds() const {
+        int deadEnds = 0;
+        for (int i = 0; i < rows; i++) {
+            for (int j = 0; j < cols; j++) {
+                if (isDeadEnd(i, j))
+                    deadEnds++;
+            }
+        }
+        return deadEnds;
+    }
+
+    // Bytes used by the grid itself
+    size_t gridBytes() const {
+        return sizeof(grid) + rows * (sizeof(vector<Cell>) + cols * sizeof(Cell));
+    }
+
     // Save maze to file so students can load it
     void saveMaze(const string& filename) const {
         ofstream outFile(filename);
@@ -100,6 +437,13 @@ public:
         cout << "Maze saved to " << filename << endl;
     }
 
+    // Save maze in the compressed block format described in mzc.h
+    void saveCompressedMaze(const string& filename) const {
+        if (saveCompressed(filename, grid, rows, cols)) {
+            cout << "Compressed maze saved to " << filename << endl;
+        }
+    }
+
     // Load maze from file
     bool loadMaze(const string& filename) {
         ifstream inFile(filename);
@@ -181,6 +525,44 @@ public:
     }
 };
 
+// Time every generator on an r x c maze and report throughput and memory.
+// Trial t uses seed + t, so each trial builds a different maze. Aux KB is
+// the peak heap held by the generator's working containers (see auxBytes).
+void benchmarkGenerators(int r, int c, double braidFraction, int trials, unsigned seed) {
+    cout << left << setw(24) << "Algorithm"
+         << right << setw(12) << "Avg ms"
+         << setw(16) << "Cells/sec"
+         << setw(12) << "Grid KB"
+         << setw(12) << "Aux KB"
+         << setw(16) << "Avg dead ends" << endl;
+
+    for (int a = 1; a <= NUM_ALGORITHMS; a++) {
+        GenAlgorithm alg = static_cast<GenAlgorithm>(a);
+        Maze m(r, c);
+        double totalMs = 0.0;
+        size_t peakAux = 0;
+        long long totalDeadEnds = 0;
+
+        for (int t = 0; t < trials; t++) {
+            auto genStart = chrono::high_resolution_clock::now();
+            m.generateMaze(seed + t, alg, braidFraction);
+            auto genEnd = chrono::high_resolution_clock::now();
+            totalMs += chrono::duration<double, milli>(genEnd - genStart).count();
+            peakAux = max(peakAux, m.auxBytes);
+            totalDeadEnds += m.countDeadEnds();
+        }
+
+        double avgMs = totalMs / trials;
+        double cellsPerSec = avgMs > 0.0 ? (double)r * c / (avgMs / 1000.0) : 0.0;
+        cout << left << setw(24) << algorithmName(alg)
+             << right << fixed << setprecision(2) << setw(12) << avgMs
+             << setprecision(0) << setw(16) << cellsPerSec
+             << setprecision(1) << setw(12) << m.gridBytes() / 1024.0
+             << setw(12) << peakAux / 1024.0
+             << setw(16) << (double)totalDeadEnds / trials << endl;
+    }
+}
+
 int main() {
     ios::sync_with_stdio(false);
     cin.tie(nullptr);
@@ -201,18 +583,64 @@ int main() {
             continue;
         }
         
+        int algChoice;
+        cout << "Select generation algorithm:" << endl;
+        for (int a = 1; a <= NUM_ALGORITHMS; a++) {
+            cout << "  " << a << ") " << algorithmName(static_cast<GenAlgorithm>(a)) << endl;
+        }
+        cout << "  0) Benchmark all algorithms" << endl;
+        cout << "Choice: ";
+        cin >> algChoice;
+        if (algChoice < 0 || algChoice > NUM_ALGORITHMS) {
+            cout << "Invalid algorithm. Please choose 0-" << NUM_ALGORITHMS << "." << endl;
+            continue;
+        }
+
+        double braidFraction;
+        cout << "Fraction of dead ends to remove for loops (0 = perfect maze, 0.5 = half, 1 = all): ";
+        cin >> braidFraction;
+        if (braidFraction < 0.0 || braidFraction > 1.0) {
+            cout << "Invalid fraction. Please enter a value between 0 and 1." << endl;
+            continue;
+        }
+
+        unsigned seed;
+        cout << "Random seed (0 = use current time): ";
+        cin >> seed;
+        if (seed == 0) {
+            seed = static_cast<unsigned>(time(nullptr));
+        }
+        cout << "Using seed " << seed << endl;
+
+        if (algChoice == 0) {
+            int trials;
+            cout << "Number of trials per algorithm: ";
+            cin >> trials;
+            if (trials <= 0) {
+                cout << "Invalid number of trials. Please enter a positive number." << endl;
+                continue;
+            }
+            benchmarkGenerators(r, c, braidFraction, trials, seed);
+
+            cout << "Do you want to generate a new maze? (y/n): ";
+            cin >> genNewMaze;
+            continue;
+        }
+
         Maze m(r, c);
+        GenAlgorithm alg = static_cast<GenAlgorithm>(algChoice);
         
         // Time the maze generation
         auto genStart = chrono::high_resolution_clock::now();
-        m.generateMaze();
+        m.generateMaze(seed, alg, braidFraction);
         auto genEnd = chrono::high_resolution_clock::now();
         auto genDuration = chrono::duration_cast<chrono::milliseconds>(genEnd - genStart);
-        cout << "Maze generated in " << fixed << setprecision(2) << genDuration.count() << " milliseconds." << endl;
+        cout << "Maze generated with " << algorithmName(alg) << " in " << fixed << setprecision(2) << genDuration.count() << " milliseconds." << endl;
         
         // Save the maze to file for students to load
         string mazeFile = "maze_" + to_string(r) + "x" + to_string(c) + ".txt";
         m.saveMaze(mazeFile);
+        m.saveCompressedMaze("maze_" + to_string(r) + "x" + to_string(c) + ".mzc");
         
         // Display the unsolved maze
         cout << "Generated maze:" << endl;
@@ -0,0 +1,228 @@
+// Compressed maze files (.mzc), shared by the generator and the solvers.
+//
+// Layout, all integers little-endian:
+//   "MZC1" | rows, cols, rowsPerBlock, numBlocks (uint32)
+//   | block offsets (numBlocks + 1 x uint64, relative to the first block)
+//   | blocks
+// Each block covers rowsPerBlock rows and decodes on its own. It holds the
+// top walls of its first row (1 bit per column), the left wall of each of
+// its rows (1 bit per row), then 2 bits per cell (right, bottom). Each
+// section is padded to a whole byte. Top and left walls of other cells are
+// taken from their neighbors.
+
+#ifndef MZC_H
+#define MZC_H
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+const char MZC_MAGIC[4] = {'M', 'Z', 'C', '1'};
+const int MZC_ROWS_PER_BLOCK = 64;
+// Largest rows or cols accepted when loading, to reject corrupt headers
+const uint32_t MZC_MAX_DIM = 1 << 20;
+
+inline void writeU32(std::ofstream& out, uint32_t v) {
+    for (int i = 0; i < 4; i++)
+        out.put(static_cast<char>((v >> (8 * i)) & 0xFF));
+}
+
+inline void writeU64(std::ofstream& out, uint64_t v) {
+    for (int i = 0; i < 8; i++)
+        out.put(static_cast<char>((v >> (8 * i)) & 0xFF));
+}
+
+inline uint32_t readU32(std::ifstream& in) {
+    unsigned char b[4] = {0};
+    in.read(reinterpret_cast<char*>(b), 4);
+    return b[0] | (b[1] << 8) | (b[2] << 16) | ((uint32_t)b[3] << 24);
+}
+
+inline uint64_t readU64(std::ifstream& in) {
+    uint64_t lo = readU32(in);
+    uint64_t hi = readU32(in);
+    return lo | (hi << 32);
+}
+
+// Size in bytes of a block holding blockRows rows of cols cells
+inline uint64_t mzcBlockBytes(uint64_t blockRows, uint64_t cols) {
+    return (cols + 7) / 8 + (blockRows + 7) / 8 + (blockRows * cols + 3) / 4;
+}
+
+// Write a rows x cols grid of cells (each with walls[4]) to an .mzc file
+template <typename Grid>
+bool saveCompressed(const std::string& filename, const Grid& grid, int rows, int cols,
+                    int rowsPerBlock = MZC_ROWS_PER_BLOCK) {
+    std::ofstream outFile(filename, std::ios::binary);
+    if (!outFile) {
+        std::cerr << "Error: Could not open file for writing." << std::endl;
+        return false;
+    }
+
+    int numBlocks = (rows + rowsPerBlock - 1) / rowsPerBlock;
+    std::vector<std::vector<unsigned char>> blocks(numBlocks);
+    for (int b = 0; b < numBlocks; b++) {
+        int firstRow = b * rowsPerBlock;
+        int blockRows = std::min(rowsPerBlock, rows - firstRow);
+        int topBytes = (cols + 7) / 8;
+        int leftBytes = (blockRows + 7) / 8;
+        std::vector<unsigned char>& block = blocks[b];
+        block.assign(mzcBlockBytes(blockRows, cols), 0);
+
+        for (int j = 0; j < cols; j++) {
+            if (grid[firstRow][j].walls[0])
+                block[j >> 3] |= 1 << (j & 7);
+        }
+        for (int k = 0; k < blockRows; k++) {
+            if (grid[firstRow + k][0].walls[3])
+                block[topBytes + (k >> 3)] |= 1 << (k & 7);
+        }
+        unsigned char* cells = block.data() + topBytes + leftBytes;
+        size_t idx = 0;
+        for (int i = firstRow; i < firstRow + blockRows; i++) {
+            for (int j = 0; j < cols; j++, idx++) {
+                int bits = grid[i][j].walls[1] | (grid[i][j].walls[2] << 1);
+                cells[idx >> 2] |= bits << ((idx & 3) * 2);
+            }
+        }
+    }
+
+    outFile.write(MZC_MAGIC, 4);
+    writeU32(outFile, rows);
+    writeU32(outFile, cols);
+    writeU32(outFile, rowsPerBlock);
+    writeU32(outFile, numBlocks);
+    uint64_t offset = 0;
+    for (int b = 0; b < numBlocks; b++) {
+        writeU64(outFile, offset);
+        offset += blocks[b].size();
+    }
+    writeU64(outFile, offset);
+    for (auto& block : blocks) {
+        outFile.write(reinterpret_cast<const char*>(block.data()), block.size());
+    }
+    outFile.close();
+    return true;
+}
+
+// Read rows firstRow..lastRow of an .mzc file into grid. Only the blocks
+// covering those rows are read, and grid holds only those rows: grid[0] is
+// row firstRow of the full maze. lastRow < 0 means the last row; any other
+// range outside the maze is an error. On success, rows and cols are set to
+// the size of the full maze and lastRow to the last row loaded. On failure
+// none of the arguments are changed.
+template <typename Grid>
+bool loadCompressed(const std::string& filename, Grid& grid, int& rows, int& cols,
+                    int firstRow, int& lastRow) {
+    std::ifstream inFile(filename, std::ios::binary);
+    if (!inFile) {
+        std::cerr << "Error: Could not open file '" << filename << "' for reading." << std::endl;
+        return false;
+    }
+
+    // Validate the whole header and index before allocating anything
+    char magic[4] = {0};
+    inFile.read(magic, 4);
+    uint32_t fileRows = readU32(inFile);
+    uint32_t fileCols = readU32(inFile);
+    uint32_t rowsPerBlock = readU32(inFile);
+    uint32_t numBlocks = readU32(inFile);
+    if (!inFile || !std::equal(magic, magic + 4, MZC_MAGIC) ||
+        fileRows == 0 || fileRows > MZC_MAX_DIM || fileCols == 0 || fileCols > MZC_MAX_DIM ||
+        rowsPerBlock == 0 || rowsPerBlock > MZC_MAX_DIM ||
+        numBlocks != ((uint64_t)fileRows + rowsPerBlock - 1) / rowsPerBlock) {
+        std::cerr << "Error: '" << filename << "' is not a valid compressed maze file." << std::endl;
+        return false;
+    }
+
+    std::vector<uint64_t> offsets(numBlocks + 1);
+    for (auto& off : offsets)
+        off = readU64(inFile);
+    if (!inFile || offsets[0] != 0) {
+        std::cerr << "Error: Corrupt block index in '" << filename << "'." << std::endl;
+        return false;
+    }
+    for (uint32_t b = 0; b < numBlocks; b++) {
+        uint64_t blockRows = std::min<uint64_t>(rowsPerBlock, fileRows - (uint64_t)b * rowsPerBlock);
+        if (offsets[b + 1] < offsets[b] ||
+            offsets[b + 1] - offsets[b] != mzcBlockBytes(blockRows, fileCols)) {
+            std::cerr << "Error: Corrupt block index in '" << filename << "'." << std::endl;
+            return false;
+        }
+    }
+    std::streamoff dataStart = inFile.tellg();
+    inFile.seekg(0, std::ios::end);
+    if (dataStart < 0 || inFile.tellg() != dataStart + (std::streamoff)offsets.back()) {
+        std::cerr << "Error: '" << filename << "' is truncated or has trailing data." << std::endl;
+        return false;
+    }
+
+    int totalRows = fileRows, totalCols = fileCols;
+    int endRow = (lastRow < 0) ? totalRows - 1 : lastRow;
+    if (firstRow < 0 || firstRow > endRow || endRow >= totalRows) {
+        std::cerr << "Error: Rows " << firstRow << " to " << endRow << " are not in '" << filename
+                  << "', which has rows 0 to " << totalRows - 1 << "." << std::endl;
+        return false;
+    }
+    int count = endRow - firstRow + 1;
+    // Decode into a separate grid so a failed load leaves grid untouched
+    Grid decoded(count, typename Grid::value_type(totalCols));
+
+    int perBlock = rowsPerBlock;
+    std::vector<unsigned char> block;
+    for (int b = firstRow / perBlock; b <= endRow / perBlock; b++) {
+        int blockFirst = b * perBlock;
+        int blockRows = std::min(perBlock, totalRows - blockFirst);
+        int topBytes = (totalCols + 7) / 8;
+        int leftBytes = (blockRows + 7) / 8;
+
+        block.resize(offsets[b + 1] - offsets[b]);
+        inFile.seekg(dataStart + (std::streamoff)offsets[b]);
+        inFile.read(reinterpret_cast<char*>(block.data()), block.size());
+        if (!inFile) {
+            std::cerr << "Error: Unexpected end of file in '" << filename << "'." << std::endl;
+            return false;
+        }
+
+        if (blockFirst >= firstRow) {
+            for (int j = 0; j < totalCols; j++) {
+                decoded[blockFirst - firstRow][j].walls[0] = (block[j >> 3] >> (j & 7)) & 1;
+            }
+        }
+        // Decode the requested rows, plus the row above them when it is in
+        // this block, since its bottom walls are the first row's top walls
+        int from = std::max(blockFirst, firstRow - 1);
+        int to = std::min(blockFirst + blockRows - 1, endRow);
+        for (int i = std::max(blockFirst, firstRow); i <= to; i++) {
+            int k = i - blockFirst;
+            decoded[i - firstRow][0].walls[3] = (block[topBytes + (k >> 3)] >> (k & 7)) & 1;
+        }
+        const unsigned char* cells = block.data() + topBytes + leftBytes;
+        for (int i = from; i <= to; i++) {
+            int local = i - firstRow;
+            size_t idx = (size_t)(i - blockFirst) * totalCols;
+            for (int j = 0; j < totalCols; j++, idx++) {
+                int bits = cells[idx >> 2] >> ((idx & 3) * 2);
+                bool right = bits & 1, bottom = (bits >> 1) & 1;
+                if (local >= 0) {
+                    decoded[local][j].walls[1] = right;
+                    decoded[local][j].walls[2] = bottom;
+                    if (j + 1 < totalCols) decoded[local][j + 1].walls[3] = right;
+                }
+                if (local + 1 < count) decoded[local + 1][j].walls[0] = bottom;
+            }
+        }
+    }
+    inFile.close();
+
+    grid.swap(decoded);
+    rows = totalRows;
+    cols = totalCols;
+    lastRow = endRow;
+    return true;
+}
+
+#endif
@@ -9,6 +9,8 @@
 #include <string>
 #include <fstream>
 
+#include "mzc.h"
+
 using namespace std;
 
 // Directions: 0 = top, 1 = right, 2 = bottom, 3 = left
@@ -20,6 +22,7 @@ class Maze {
 public:
     int rows, cols;
     vector<vector<Cell>> grid;
+    int rowOffset = 0; // row of the full maze stored in grid[0]
 
     Maze(int r, int c) : rows(r), cols(c) {
         grid.resize(rows, vector<Cell>(cols));
@@ -30,8 +33,12 @@ public:
         return (r >= 0 && r < rows && c >= 0 && c < cols);
     }
 
-    // Load maze from file
+    // Load maze from file (.mzc files are read as compressed mazes)
     bool loadMaze(const string& filename) {
+        if (filename.size() >= 4 && filename.compare(filename.size() - 4, 4, ".mzc") == 0)
+            return loadCompressedMaze(filename);
+
+        rowOffset = 0;
         ifstream inFile(filename);
         if (!inFile) {
             cerr << "Error: Could not open file '" << filename << "' for reading." << endl;
@@ -54,6 +61,19 @@ public:
         return true;
     }
 
+    // Load maze from a compressed (.mzc) file. Only rows firstRow..lastRow
+    // are read and stored: grid[0] is row rowOffset of the full maze.
+    // By default the whole maze is loaded.
+    bool loadCompressedMaze(const string& filename, int firstRow = 0, int lastRow = -1) {
+        int fileRows, fileCols;
+        if (!loadCompressed(filename, grid, fileRows, fileCols, firstRow, lastRow))
+            return false;
+        rows = lastRow - firstRow + 1;
+        cols = fileCols;
+        rowOffset = firstRow;
+        return true;
+    }
+
     // Display the maze in ASCII art with the solution path
     void displayMaze(const vector<pair<int,int>> &path, pair<int,int> start, pair<int,int> end) const {
         // Create a grid to mark solution path for quick lookup